@@ -10,9 +10,11 @@
 
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypes.h"
+#include "include/private/base/SkAlign.h"
 #include "include/private/base/SkAnySubclass.h"
 
 #include <cstddef>
+#include <cstdint>
 
 namespace skgpu {
 enum class BackendApi : unsigned int;
@@ -43,13 +45,26 @@ public:
     // Returns true if the backend mutable state has been initialized.
     bool isValid() const { return fIsValid; }
 
+    // MutableTextureStates are small, fixed-size, and allocated every time a client wraps or
+    // updates a backend texture, so freed instances are recycled through a free list instead of
+    // going back to the heap; see MutableTextureState.cpp.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+
 private:
     friend class MutableTextureStateData;
     friend class MutableTextureStatePriv;
-    // Size determined by looking at the MutableTextureStateData subclasses, then
-    // guessing-and-checking. Compiler will complain if this is too small - in that case,
-    // just increase the number.
-    inline constexpr static size_t kMaxSubclassSize = 16;
+    // The only MutableTextureStateData subclass today is the Vulkan one: a vtable pointer plus a
+    // packed std::atomic<uint64_t> layout/queue-family word. The atomic is aligned to its full
+    // 8-byte size on every supported target -- including i386, where a plain uint64_t is only
+    // 4-aligned -- so the padding is computed against sizeof(uint64_t) rather than pulling
+    // <atomic> into this public header; the subclass's definition static_asserts both the
+    // alignment assumption and that this computed size stays exact, so the inline storage is
+    // never silently over- or under-provisioned the way the old guessed-and-checked constant
+    // could be.
+    inline constexpr static size_t kVulkanStateSize =
+            SkAlignTo(sizeof(void*), sizeof(uint64_t)) + sizeof(uint64_t);
+    inline constexpr static size_t kMaxSubclassSize = kVulkanStateSize;
     using AnyStateData = SkAnySubclass<MutableTextureStateData, kMaxSubclassSize>;
 
     template <typename StateData>
@@ -10,8 +10,11 @@
 
 #include "include/core/SkRefCnt.h"
 #include "include/gpu/graphite/GraphiteTypes.h"
+#include "include/private/base/SkAlign.h"
 #include "include/private/base/SkAnySubclass.h"
 
+#include <cstdint>
+
 #if defined(SK_METAL) && !defined(SK_DISABLE_LEGACY_BACKEND_SEMAPHORE_FUNCS)
 #include <CoreFoundation/CoreFoundation.h>
 #endif
@@ -53,10 +56,13 @@ private:
     friend class BackendSemaphoreData;
     friend class BackendSemaphorePriv;
 
-    // Size determined by looking at the BackendSemaphoreData subclasses, then
-    // guessing-and-checking. Compiler will complain if this is too small - in that case, just
-    // increase the number.
-    inline constexpr static size_t kMaxSubclassSize = 24;
+    // The only BackendSemaphoreData subclass today is the Metal one: a vtable pointer, an event
+    // handle, and a 64-bit value. Its definition static_asserts that this computed size stays
+    // exact, so the inline storage is never silently over- or under-provisioned the way the old
+    // guessed-and-checked constant could be.
+    inline constexpr static size_t kMtlEventDataSize =
+            SkAlignTo(2 * sizeof(void*), alignof(uint64_t)) + sizeof(uint64_t);
+    inline constexpr static size_t kMaxSubclassSize = kMtlEventDataSize;
     using AnyBackendSemaphoreData = SkAnySubclass<BackendSemaphoreData, kMaxSubclassSize>;
 
     template <typename SomeBackendSemaphoreData>
@@ -12,7 +12,9 @@
 #include "include/core/SkSize.h"
 #include "include/gpu/graphite/GraphiteTypes.h"
 #include "include/gpu/graphite/TextureInfo.h"
-#include "include/private/base/SkAnySubclass.h"
+
+#include <cstdint>
+#include <cstring>
 
 #ifdef SK_DAWN
 #include "include/gpu/graphite/dawn/DawnTypes.h"
@@ -33,8 +35,6 @@ class MutableTextureState;
 
 namespace skgpu::graphite {
 
-class BackendTextureData;
-
 class SK_API BackendTexture {
 public:
     BackendTexture();
@@ -91,10 +91,14 @@ public:
 #endif
 
     BackendTexture(const BackendTexture&);
+    // The handles and packed info are trivially movable, so the defaulted moves just transfer
+    // fMutableState's reference without the refcount round trip a copy pays.
+    BackendTexture(BackendTexture&&) = default;
 
     ~BackendTexture();
 
     BackendTexture& operator=(const BackendTexture&);
+    BackendTexture& operator=(BackendTexture&&) = default;
 
     bool operator==(const BackendTexture&) const;
     bool operator!=(const BackendTexture& that) const { return !(*this == that); }
@@ -126,36 +130,43 @@ public:
 #endif
 
 private:
-    friend class BackendTextureData;
     friend class BackendTexturePriv;
 
-    // Size determined by looking at the BackendTextureData subclasses, then guessing-and-checking.
-    // Compiler will complain if this is too small - in that case, just increase the number.
-    inline constexpr static size_t kMaxSubclassSize = 16;
-    using AnyBackendTextureData = SkAnySubclass<BackendTextureData, kMaxSubclassSize>;
-
-    template <typename SomeBackendTextureData>
-    BackendTexture(SkISize dimensions, TextureInfo info, const SomeBackendTextureData& textureData)
-            : fDimensions(dimensions), fInfo(info) {
-        fTextureData.emplace<SomeBackendTextureData>(textureData);
-    }
+#ifdef SK_METAL
+    BackendTexture(SkISize dimensions, const TextureInfo& info, MtlHandle mtlTexture)
+            : fDimensions(dimensions), fInfo(info), fMtlTexture(mtlTexture) {}
+#endif
 
     friend class VulkanResourceProvider;    // for getMutableState
     sk_sp<MutableTextureState> getMutableState() const;
 
+    // The two 32-bit dimensions viewed as one word, so equality is a single compare even in
+    // unoptimized builds; memcpy keeps the type pun well-defined and compiles away.
+    uint64_t dimsAsU64() const {
+        static_assert(sizeof(SkISize) == sizeof(uint64_t));
+        uint64_t v;
+        memcpy(&v, &fDimensions, sizeof(v));
+        return v;
+    }
+
     SkISize fDimensions;
     TextureInfo fInfo;
-    AnyBackendTextureData fTextureData;
 
+#ifdef SK_VULKAN
+    // The mutable state (image layout and queue family index) is only tracked for Vulkan images.
+    // Keeping it gated here avoids an sk_sp allocation and refcount traffic on every
+    // BackendTexture copy for the other backends.
     sk_sp<MutableTextureState> fMutableState;
 
-#ifdef SK_VULKAN
     // fMemoryAlloc == VulkanAlloc() if the client has already created their own VkImage and
     // will destroy it themselves as opposed to having Skia create/destroy it via
     // Recorder::createBackendTexture and Context::deleteBackendTexture.
     VulkanAlloc fMemoryAlloc = VulkanAlloc();
 #endif
 
+    // The native texture handle(s), discriminated by fInfo's backend tag just like the spec
+    // union inside TextureInfo. As there, the union vanishes in backend-less builds.
+#if defined(SK_DAWN) || defined(SK_METAL) || defined(SK_VULKAN)
     union {
 #ifdef SK_DAWN
         struct {
@@ -163,11 +174,14 @@ private:
             WGPUTextureView fDawnTextureView;
         };
 #endif
+#ifdef SK_METAL
+        MtlHandle fMtlTexture;
+#endif
 #ifdef SK_VULKAN
         VkImage fVkImage = VK_NULL_HANDLE;
 #endif
-        void* fEnsureUnionNonEmpty;
     };
+#endif
 };
 
 } // namespace skgpu::graphite
@@ -12,12 +12,15 @@
 #include "include/core/SkTextureCompressionType.h"
 #include "include/gpu/graphite/GraphiteTypes.h"
 #include "include/private/base/SkAPI.h"
-#include "include/private/base/SkAnySubclass.h"
 
 #ifdef SK_DAWN
 #include "include/private/gpu/graphite/DawnTypesPriv.h"
 #endif
 
+#ifdef SK_METAL
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
+#endif
+
 #ifdef SK_VULKAN
 #include "include/private/gpu/graphite/VulkanGraphiteTypesPriv.h"
 #endif
@@ -26,15 +29,13 @@ struct SkISize;
 
 namespace skgpu::graphite {
 
-class TextureInfoData;
-
 #if defined(SK_METAL) && !defined(SK_DISABLE_LEGACY_TEXTURE_INFO_FUNCS)
 struct MtlTextureInfo;
 #endif
 
 class SK_API TextureInfo {
 public:
-    TextureInfo();
+    TextureInfo() {}
 #ifdef SK_DAWN
     TextureInfo(const DawnTextureInfo& dawnInfo);
 #endif
@@ -47,19 +48,29 @@ public:
     TextureInfo(const VulkanTextureInfo& vkInfo);
 #endif
 
-    ~TextureInfo();
-    TextureInfo(const TextureInfo&);
-    TextureInfo& operator=(const TextureInfo&);
+    // The specs in the union are all trivially copyable, so copies and assignments are too; the
+    // compiler can copy the whole struct with a handful of vector loads and stores.
+    ~TextureInfo() = default;
+    TextureInfo(const TextureInfo&) = default;
+    TextureInfo& operator=(const TextureInfo&) = default;
 
     bool operator==(const TextureInfo&) const;
     bool operator!=(const TextureInfo& that) const { return !(*this == that); }
 
-    bool isValid() const { return fValid; }
-    BackendApi backend() const { return fBackend; }
+    // The backend tag doubles as the valid flag: kMock is only ever stored by the
+    // default-constructed (invalid) info, and every backend constructor stores its own tag.
+    bool isValid() const { return this->backend() != BackendApi::kMock; }
+    BackendApi backend() const {
+        return static_cast<BackendApi>((fPacked & kBackendMask) >> kBackendShift);
+    }
 
-    uint32_t numSamples() const { return fSampleCount; }
-    Mipmapped mipmapped() const { return fMipmapped; }
-    Protected isProtected() const { return fProtected; }
+    uint32_t numSamples() const { return (fPacked & kSampleCountMask) >> kSampleCountShift; }
+    Mipmapped mipmapped() const {
+        return (fPacked & kMipmappedMask) ? Mipmapped::kYes : Mipmapped::kNo;
+    }
+    Protected isProtected() const {
+        return (fPacked & kProtectedMask) ? Protected::kYes : Protected::kNo;
+    }
     SkTextureCompressionType compressionType() const;
 
 #ifdef SK_DAWN
@@ -68,46 +79,89 @@ public:
 
 #ifdef SK_VULKAN
     bool getVulkanTextureInfo(VulkanTextureInfo* info) const {
-        if (!this->isValid() || fBackend != BackendApi::kVulkan) {
+        if (!this->isValid() || this->backend() != BackendApi::kVulkan) {
             return false;
         }
-        *info = VulkanTextureSpecToTextureInfo(fVkSpec, fSampleCount, fMipmapped);
+        *info = VulkanTextureSpecToTextureInfo(fVkSpec, this->numSamples(), this->mipmapped());
         return true;
     }
 #endif
 
     bool isCompatible(const TextureInfo& that) const;
+    // Append the full description of this TextureInfo to str. Callers assembling a larger label
+    // or log line can reuse one buffer instead of allocating a temporary string per info.
+    void appendTo(SkString* str) const;
+    // Append only the info relevant for its use as a RenderPass attachment.
+    void appendRPAttachmentTo(SkString* str) const;
     // Return a string containing the full description of this TextureInfo.
     SkString toString() const;
     // Return a string containing only the info relevant for its use as a RenderPass attachment.
     SkString toRPAttachmentString() const;
 
 private:
-    friend class TextureInfoData;
     friend class TextureInfoPriv;
 
-    // Size determined by looking at the TextureInfoData subclasses, then guessing-and-checking.
-    // Compiler will complain if this is too small - in that case, just increase the number.
-    inline constexpr static size_t kMaxSubclassSize = 40;
-    using AnyTextureInfoData = SkAnySubclass<TextureInfoData, kMaxSubclassSize>;
-
-    template <typename SomeTextureInfoData>
-    TextureInfo(BackendApi backend,
-                uint32_t sampleCount,
-                skgpu::Mipmapped mipped,
-                skgpu::Protected isProtected,
-                const SomeTextureInfoData& textureInfoData)
-            : fBackend(backend)
-            , fValid(true)
-            , fSampleCount(sampleCount)
-            , fMipmapped(mipped)
-            , fProtected(isProtected) {
-        fTextureInfoData.emplace<SomeTextureInfoData>(textureInfoData);
+    // The scalar state is packed into a single word to keep TextureInfo compact; it's embedded in
+    // BackendTexture and in pipeline/resource keys that get compared on hot paths.
+    // fPacked layout, low to high bit:
+    //  [ 0, 4): backend (kMock doubles as "invalid"; no separate valid bit)
+    //  [ 4, 5): mipmapped
+    //  [ 5, 6): protected
+    //  [ 8,16): sample count
+    //  [16,24): bytes per pixel, cached from the backend format at construction
+    inline constexpr static uint32_t kBackendShift       = 0;
+    inline constexpr static uint32_t kBackendMask        = 0xF << kBackendShift;
+    inline constexpr static uint32_t kMipmappedMask      = 1u << 4;
+    inline constexpr static uint32_t kProtectedMask      = 1u << 5;
+    inline constexpr static uint32_t kSampleCountShift   = 8;
+    inline constexpr static uint32_t kSampleCountMask    = 0xFF << kSampleCountShift;
+    inline constexpr static uint32_t kBytesPerPixelShift = 16;
+    inline constexpr static uint32_t kBytesPerPixelMask  = 0xFF << kBytesPerPixelShift;
+
+    // The scalar bits that must match for two TextureInfos to be compatible as render targets.
+    // Today that is every packed field (bytes-per-pixel is derived from the format, which the
+    // spec-level isCompatible requires to match anyway); any future field that may legitimately
+    // differ between compatible infos just gets left out of the mask.
+    inline constexpr static uint32_t kCompatibilityMask =
+            kBackendMask | kMipmappedMask | kProtectedMask |
+            kSampleCountMask | kBytesPerPixelMask;
+
+    constexpr static uint32_t Pack(BackendApi backend,
+                                   uint32_t sampleCount,
+                                   skgpu::Mipmapped mipped,
+                                   skgpu::Protected isProtected,
+                                   size_t bytesPerPixel) {
+        return (static_cast<uint32_t>(backend) << kBackendShift) |
+               (mipped == skgpu::Mipmapped::kYes ? kMipmappedMask : 0) |
+               (isProtected == skgpu::Protected::kYes ? kProtectedMask : 0) |
+               (sampleCount << kSampleCountShift) |
+               (static_cast<uint32_t>(bytesPerPixel) << kBytesPerPixelShift);
     }
 
+    // Hashes fPacked plus exactly the spec state that operator== compares, so differing hashes
+    // prove inequality. Called once at the end of each backend constructor; TextureInfo is
+    // immutable afterwards so the result never goes stale.
+    uint32_t computeHash() const;
+
+    // Like computeHash(), but over the masked scalar word and only the spec fields that
+    // compatibility requires to match exactly, so differing hashes prove incompatibility. The
+    // asymmetric rules (usage supersets, Dawn's wildcard aspect) stay out of the hash and are
+    // re-checked by isCompatible() when the hashes tie.
+    uint32_t computeCompatHash() const;
+
+    // Cold per-backend operations (string formatting, compression-type queries) are dispatched
+    // through a static table indexed by the backend tag; see TextureInfo.cpp. Sharing one static
+    // table avoids growing every TextureInfo by a table pointer, and the hot comparisons stay on
+    // the packed-word and hash fast paths.
+    struct BackendOps;
+    static const BackendOps kBackendOps[];
+    static const BackendOps& Ops(BackendApi);
+
     friend size_t ComputeSize(SkISize dimensions, const TextureInfo&);  // for bytesPerPixel
 
-    size_t bytesPerPixel() const;
+    // Cached from the backend format when the TextureInfo was constructed so that ComputeSize
+    // doesn't have to re-derive it from the spec on every resource budgeting call.
+    size_t bytesPerPixel() const { return (fPacked & kBytesPerPixelMask) >> kBytesPerPixelShift; }
 
 #ifdef SK_DAWN
     friend class DawnCaps;
@@ -117,11 +171,32 @@ private:
     friend class DawnResourceProvider;
     friend class DawnTexture;
     const DawnTextureSpec& dawnTextureSpec() const {
-        SkASSERT(fValid && fBackend == BackendApi::kDawn);
+        SkASSERT(this->isValid() && this->backend() == BackendApi::kDawn);
         return fDawnSpec;
     }
 #endif
 
+#ifdef SK_METAL
+    TextureInfo(const MtlTextureSpec& mtlSpec,
+                uint32_t sampleCount,
+                skgpu::Mipmapped mipped,
+                skgpu::Protected isProtected)
+            : fPacked(Pack(BackendApi::kMetal,
+                           sampleCount,
+                           mipped,
+                           isProtected,
+                           MtlFormatBytesPerBlock(mtlSpec.fFormat)))
+            , fMtlSpec(mtlSpec) {
+        fHash = this->computeHash();
+        fCompatHash = this->computeCompatHash();
+    }
+
+    const MtlTextureSpec& mtlTextureSpec() const {
+        SkASSERT(this->isValid() && this->backend() == BackendApi::kMetal);
+        return fMtlSpec;
+    }
+#endif
+
 #ifdef SK_VULKAN
     friend class VulkanCaps;
     friend class VulkanResourceProvider;
@@ -130,29 +205,38 @@ private:
     friend class PaintParamsKey;
 
     const VulkanTextureSpec& vulkanTextureSpec() const {
-        SkASSERT(fValid && fBackend == BackendApi::kVulkan);
+        SkASSERT(this->isValid() && this->backend() == BackendApi::kVulkan);
         return fVkSpec;
     }
 #endif
 
-    BackendApi fBackend = BackendApi::kMock;
-    bool fValid = false;
-
-    uint32_t fSampleCount = 1;
-    Mipmapped fMipmapped = Mipmapped::kNo;
-    Protected fProtected = Protected::kNo;
-
-    AnyTextureInfoData fTextureInfoData;
-
+    uint32_t fPacked = Pack(BackendApi::kMock,
+                            /*sampleCount=*/1,
+                            Mipmapped::kNo,
+                            Protected::kNo,
+                            /*bytesPerPixel=*/0);
+
+    // Cached hashes of the full equality state and of the compatibility subset; see
+    // computeHash() and computeCompatHash(). Zero for invalid infos, which never reach a
+    // backend constructor.
+    uint32_t fHash = 0;
+    uint32_t fCompatHash = 0;
+
+    // In a build with no GPU backends enabled (e.g. mock-only testing) the union disappears
+    // entirely rather than paying for a placeholder member in every TextureInfo.
+#if defined(SK_DAWN) || defined(SK_METAL) || defined(SK_VULKAN)
     union {
 #ifdef SK_DAWN
         DawnTextureSpec fDawnSpec;
 #endif
+#ifdef SK_METAL
+        MtlTextureSpec fMtlSpec;
+#endif
 #ifdef SK_VULKAN
         VulkanTextureSpec fVkSpec;
 #endif
-        void* fEnsureUnionNonEmpty;
     };
+#endif
 };
 
 }  // namespace skgpu::graphite
@@ -50,7 +50,7 @@ struct DawnTextureSpec {
         return fViewFormat != wgpu::TextureFormat::Undefined ? fViewFormat : fFormat;
     }
 
-    SkString toString() const;
+    void appendTo(SkString* str) const;
 
     wgpu::TextureFormat fFormat = wgpu::TextureFormat::Undefined;
     // `fViewFormat` is always single plane format or plane view format for a multiplanar
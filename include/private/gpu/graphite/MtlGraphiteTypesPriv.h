@@ -9,12 +9,13 @@
 #define skgpu_graphite_MtlGraphiteTypesPriv_DEFINED
 
 #include "include/core/SkString.h"
+#include "include/core/SkTextureCompressionType.h"
 #include "include/gpu/graphite/GraphiteTypes.h"
-#include "include/gpu/graphite/TextureInfo.h"
-#include "include/gpu/graphite/mtl/MtlGraphiteTypes.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
+#if __OBJC__  // <Metal/Metal.h> only works when compiled for Objective C
+
 #include <TargetConditionals.h>
 
 // We're using the MSL version as shorthand for the Metal SDK version here
@@ -42,19 +43,26 @@
 
 #import <Metal/Metal.h>
 
+#endif  // __OBJC__
+
 namespace skgpu::graphite {
 
+/**
+ * Declares typedefs for Metal types used in Graphite cpp code so that the texture spec can live
+ * inside TextureInfo without dragging <Metal/Metal.h> into every C++ translation unit that
+ * includes it. All of the Metal enum values involved fit in 32 bits.
+ */
+using MtlPixelFormat = unsigned int;
+using MtlTextureUsage = unsigned int;
+using MtlStorageMode = unsigned int;
+using MtlHandle = const void*;
+
 struct MtlTextureSpec {
     MtlTextureSpec()
-            : fFormat(MTLPixelFormatInvalid)
-            , fUsage(MTLTextureUsageUnknown)
-            , fStorageMode(MTLStorageModeShared)
+            : fFormat(0)       // MTLPixelFormatInvalid
+            , fUsage(0)        // MTLTextureUsageUnknown
+            , fStorageMode(0)  // MTLStorageModeShared
             , fFramebufferOnly(false) {}
-    MtlTextureSpec(const MtlTextureInfo& info)
-            : fFormat(info.fFormat)
-            , fUsage(info.fUsage)
-            , fStorageMode(info.fStorageMode)
-            , fFramebufferOnly(info.fFramebufferOnly) {}
 
     bool operator==(const MtlTextureSpec& that) const {
         return fFormat == that.fFormat && fUsage == that.fUsage &&
@@ -67,31 +75,48 @@ struct MtlTextureSpec {
                fFramebufferOnly == that.fFramebufferOnly && (fUsage & that.fUsage) == fUsage;
     }
 
-    SkString toString() const {
-        return SkStringPrintf("format=%u,usage=0x%04X,storageMode=%u,framebufferOnly=%d",
-                              (uint32_t)fFormat,
-                              (uint32_t)fUsage,
-                              (uint32_t)fStorageMode,
-                              fFramebufferOnly);
+    void appendTo(SkString* str) const {
+        str->appendf("format=%u,usage=0x%04X,storageMode=%u,framebufferOnly=%d",
+                     fFormat,
+                     fUsage,
+                     fStorageMode,
+                     fFramebufferOnly);
     }
 
-    MTLPixelFormat fFormat;
-    MTLTextureUsage fUsage;
-    MTLStorageMode fStorageMode;
+    MtlPixelFormat fFormat;
+    MtlTextureUsage fUsage;
+    MtlStorageMode fStorageMode;
     bool fFramebufferOnly;
 };
 
+// Format queries callable from C++; defined in MtlGraphiteUtils.mm.
+size_t MtlFormatBytesPerBlock(MtlPixelFormat);
+SkTextureCompressionType MtlFormatToCompressionType(MtlPixelFormat);
+
+class TextureInfo;
+
+namespace TextureInfos {
+MtlTextureSpec GetMtlTextureSpec(const TextureInfo&);
+bool GetMtlFramebufferOnly(const TextureInfo&);
+}  // namespace TextureInfos
+
+#if __OBJC__
+
+struct MtlTextureInfo;
+
+MtlTextureSpec MtlTextureInfoToTextureSpec(const MtlTextureInfo& info);
+
 MtlTextureInfo MtlTextureSpecToTextureInfo(const MtlTextureSpec& mtlSpec,
                                            uint32_t sampleCount,
                                            Mipmapped mipmapped);
 
 namespace TextureInfos {
-MtlTextureSpec GetMtlTextureSpec(const TextureInfo&);
 MTLPixelFormat GetMTLPixelFormat(const TextureInfo&);
 MTLTextureUsage GetMTLTextureUsage(const TextureInfo&);
-bool GetMtlFramebufferOnly(const TextureInfo&);
 }  // namespace TextureInfos
 
+#endif  // __OBJC__
+
 }  // namespace skgpu::graphite
 
 #endif  // skgpu_graphite_MtlGraphiteTypesPriv_DEFINED
@@ -12,6 +12,9 @@
 #include "include/gpu/graphite/vk/VulkanGraphiteTypes.h"
 #include "include/private/gpu/vk/SkiaVulkan.h"
 
+#include <cstddef>
+#include <cstring>
+
 namespace skgpu::graphite {
 
 struct VulkanTextureSpec {
@@ -33,12 +36,14 @@ struct VulkanTextureSpec {
             , fYcbcrConversionInfo(info.fYcbcrConversionInfo) {}
 
     bool operator==(const VulkanTextureSpec& that) const {
-        return fFlags == that.fFlags &&
-               fFormat == that.fFormat &&
-               fImageTiling == that.fImageTiling &&
-               fImageUsageFlags == that.fImageUsageFlags &&
-               fSharingMode == that.fSharingMode &&
-               fAspectMask == that.fAspectMask &&
+        // The scalar fields ahead of fYcbcrConversionInfo are six contiguous 32-bit values with
+        // no padding between them, so a single fixed-size memcmp (which the compiler lowers to a
+        // couple of wide loads) replaces six compare-and-branch pairs. The conversion info can't
+        // join the memcmp: it has interior padding and its equality intentionally ignores some
+        // fields.
+        static_assert(offsetof(VulkanTextureSpec, fFlags) == 0);
+        static_assert(offsetof(VulkanTextureSpec, fYcbcrConversionInfo) == 6 * sizeof(uint32_t));
+        return memcmp(this, &that, offsetof(VulkanTextureSpec, fYcbcrConversionInfo)) == 0 &&
                fYcbcrConversionInfo == that.fYcbcrConversionInfo;
     }
 
@@ -53,8 +58,8 @@ struct VulkanTextureSpec {
                fYcbcrConversionInfo == that.fYcbcrConversionInfo;
     }
 
-    SkString toString() const {
-        return SkStringPrintf(
+    void appendTo(SkString* str) const {
+        str->appendf(
                 "flags=0x%08X,format=%d,imageTiling=%d,imageUsageFlags=0x%08X,sharingMode=%d,"
                 "aspectMask=%u",
                 fFlags,
@@ -7,10 +7,60 @@
 #include "include/gpu/MutableTextureState.h"
 
 #include "include/gpu/GpuTypes.h"
+#include "src/base/SkSpinlock.h"
 #include "src/gpu/MutableTextureStatePriv.h"
 
+#include <new>
+
 namespace skgpu {
 
+namespace {
+
+// Freed MutableTextureStates are threaded onto this free list and handed back out by the next
+// allocation. The sk_sp holding a state can be released on a different thread than the one that
+// created it (it is shared between a client's BackendTexture and Skia's wrapped texture), so the
+// list is guarded by a spinlock rather than being thread-local. The pool is capped so a burst of
+// allocations can't pin memory forever.
+struct FreeNode {
+    FreeNode* fNext;
+};
+
+constexpr int kMaxPooledStates = 64;
+
+SkSpinlock gPoolLock;
+FreeNode* gFreeList SK_GUARDED_BY(gPoolLock) = nullptr;
+int gPooledCount SK_GUARDED_BY(gPoolLock) = 0;
+
+}  // anonymous namespace
+
+void* MutableTextureState::operator new(size_t size) {
+    // A subclass-sized request (there are no subclasses today) falls through to the heap.
+    if (size == sizeof(MutableTextureState)) {
+        SkAutoSpinlock lock{gPoolLock};
+        if (FreeNode* node = gFreeList) {
+            gFreeList = node->fNext;
+            gPooledCount--;
+            return node;
+        }
+    }
+    return ::operator new(size);
+}
+
+void MutableTextureState::operator delete(void* ptr, size_t size) {
+    static_assert(sizeof(MutableTextureState) >= sizeof(FreeNode));
+    if (size == sizeof(MutableTextureState)) {
+        SkAutoSpinlock lock{gPoolLock};
+        if (gPooledCount < kMaxPooledStates) {
+            FreeNode* node = static_cast<FreeNode*>(ptr);
+            node->fNext = gFreeList;
+            gFreeList = node;
+            gPooledCount++;
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
 MutableTextureState::MutableTextureState():
     fBackend(BackendApi::kUnsupported),
     fIsValid(false) {}
@@ -34,6 +34,10 @@ private:
 
 class MutableTextureStatePriv final {
 public:
+    // Exposed so the state data subclasses can static_assert that the inline storage sizing in
+    // MutableTextureState still matches their actual layout.
+    inline constexpr static size_t kVulkanStateSize = MutableTextureState::kVulkanStateSize;
+
     template <typename StateData>
     static MutableTextureState MakeMutableTextureState(BackendApi backend,
                                                        const StateData& data) {
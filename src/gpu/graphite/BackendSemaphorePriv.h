@@ -35,6 +35,10 @@ private:
 
 class BackendSemaphorePriv {
 public:
+    // Exposed so the semaphore data subclasses can static_assert that the inline storage sizing
+    // in BackendSemaphore still matches their actual layout.
+    inline constexpr static size_t kMtlEventDataSize = BackendSemaphore::kMtlEventDataSize;
+
     template <typename SomeBackendSemaphoreData>
     static BackendSemaphore Make(BackendApi backend, const SomeBackendSemaphoreData& textureData) {
         return BackendSemaphore(backend, textureData);
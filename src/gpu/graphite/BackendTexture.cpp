@@ -39,10 +39,11 @@ BackendTexture& BackendTexture::operator=(const BackendTexture& that) {
     fInfo = that.fInfo;
 
     switch (that.backend()) {
+#ifdef SK_METAL
         case BackendApi::kMetal:
-            fTextureData.reset();
-            that.fTextureData->copyTo(fTextureData);
+            fMtlTexture = that.fMtlTexture;
             break;
+#endif
 #ifdef SK_DAWN
         case BackendApi::kDawn:
             fDawnTexture = that.fDawnTexture;
@@ -67,13 +68,18 @@ bool BackendTexture::operator==(const BackendTexture& that) const {
         return false;
     }
 
-    if (fDimensions != that.fDimensions || fInfo != that.fInfo) {
+    if (this->dimsAsU64() != that.dimsAsU64() || fInfo != that.fInfo) {
         return false;
     }
 
     switch (that.backend()) {
+#ifdef SK_METAL
         case BackendApi::kMetal:
-            return fTextureData->equal(that.fTextureData.get());
+            if (fMtlTexture != that.fMtlTexture) {
+                return false;
+            }
+            break;
+#endif
 #ifdef SK_DAWN
         case BackendApi::kDawn:
             if (fDawnTexture != that.fDawnTexture) {
@@ -98,11 +104,17 @@ bool BackendTexture::operator==(const BackendTexture& that) const {
 }
 
 void BackendTexture::setMutableState(const skgpu::MutableTextureState& newState) {
+#ifdef SK_VULKAN
     fMutableState->set(newState);
+#endif
 }
 
 sk_sp<MutableTextureState> BackendTexture::getMutableState() const {
+#ifdef SK_VULKAN
     return fMutableState;
+#else
+    return nullptr;
+#endif
 }
 
 #ifdef SK_DAWN
@@ -207,7 +219,5 @@ const VulkanAlloc* BackendTexture::getMemoryAlloc() const {
 }
 #endif // SK_VULKAN
 
-BackendTextureData::~BackendTextureData(){};
-
 } // namespace skgpu::graphite
 
@@ -7,45 +7,24 @@
 #ifndef skgpu_graphite_BackendTexturePriv_DEFINED
 #define skgpu_graphite_BackendTexturePriv_DEFINED
 
-#include "include/core/SkString.h"
 #include "include/gpu/graphite/BackendTexture.h"
 
-#include <cstdint>
-
 namespace skgpu::graphite {
 
-class BackendTextureData {
-public:
-    virtual ~BackendTextureData();
-
-#if defined(SK_DEBUG)
-    virtual skgpu::BackendApi type() const = 0;
-#endif
-protected:
-    BackendTextureData() = default;
-    BackendTextureData(const BackendTextureData&) = default;
-
-    using AnyBackendTextureData = BackendTexture::AnyBackendTextureData;
-
-private:
-    friend class BackendTexture;
-
-    virtual void copyTo(AnyBackendTextureData& dstData) const = 0;
-    virtual bool equal(const BackendTextureData* that) const = 0;
-};
-
 class BackendTexturePriv {
 public:
-    template <typename SomeBackendTextureData>
-    static BackendTexture Make(SkISize dimensions,
-                               TextureInfo info,
-                               const SomeBackendTextureData& textureData) {
-        return BackendTexture(dimensions, info, textureData);
+#ifdef SK_METAL
+    static BackendTexture MakeMtl(SkISize dimensions,
+                                  const TextureInfo& info,
+                                  MtlHandle mtlTexture) {
+        return BackendTexture(dimensions, info, mtlTexture);
     }
 
-    static const BackendTextureData* GetData(const BackendTexture& info) {
-        return info.fTextureData.get();
+    static MtlHandle GetMtlTexture(const BackendTexture& tex) {
+        SkASSERT(tex.isValid() && tex.backend() == skgpu::BackendApi::kMetal);
+        return tex.fMtlTexture;
     }
+#endif
 };
 
 }  // namespace skgpu::graphite
@@ -128,13 +128,17 @@ SkString RenderPassDesc::toPipelineLabel() const {
     }
     // TODO: Remove `fSampleCount` in label when the Dawn backend manages its MSAA color attachments
     // directly instead of relying on msaaRenderToSingleSampledSupport().
-    return SkStringPrintf("RP(color: %s%s, resolve: %s, ds: %s, samples: %u, swizzle: %s)",
-                          fColorAttachment.fTextureInfo.toRPAttachmentString().c_str(),
-                          colorLoadStr,
-                          fColorResolveAttachment.fTextureInfo.toRPAttachmentString().c_str(),
-                          fDepthStencilAttachment.fTextureInfo.toRPAttachmentString().c_str(),
-                          fSampleCount,
-                          fWriteSwizzle.asString().c_str());
+    // Append the attachment descriptions into one buffer rather than formatting each into its own
+    // temporary string.
+    SkString label("RP(color: ");
+    fColorAttachment.fTextureInfo.appendRPAttachmentTo(&label);
+    label += colorLoadStr;
+    label += ", resolve: ";
+    fColorResolveAttachment.fTextureInfo.appendRPAttachmentTo(&label);
+    label += ", ds: ";
+    fDepthStencilAttachment.fTextureInfo.appendRPAttachmentTo(&label);
+    label.appendf(", samples: %u, swizzle: %s)", fSampleCount, fWriteSwizzle.asString().c_str());
+    return label;
 }
 
 SkString AttachmentDesc::toString() const {
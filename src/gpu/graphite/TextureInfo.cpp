@@ -7,8 +7,12 @@
 
 #include "include/gpu/graphite/TextureInfo.h"
 
+#include "src/core/SkChecksum.h"
 #include "src/gpu/graphite/TextureInfoPriv.h"
 
+#include <iterator>
+#include <type_traits>
+
 #ifdef SK_DAWN
 #include "src/gpu/graphite/dawn/DawnUtilsPriv.h"
 #endif
@@ -19,92 +23,202 @@
 
 namespace skgpu::graphite {
 
-TextureInfo::TextureInfo(){};
-TextureInfo::~TextureInfo() = default;
+// Verify that the default copy/assign/destroy stays trivial: copies of TextureInfo happen on
+// per-frame image- and surface-wrapping paths.
+static_assert(std::is_trivially_copyable_v<TextureInfo>);
 
 #ifdef SK_DAWN
 TextureInfo::TextureInfo(const DawnTextureInfo& dawnInfo)
-        : fBackend(BackendApi::kDawn)
-        , fValid(true)
-        , fSampleCount(dawnInfo.fSampleCount)
-        , fMipmapped(dawnInfo.fMipmapped)
-        , fProtected(Protected::kNo)
-        , fDawnSpec(dawnInfo) {}
+        : fPacked(Pack(BackendApi::kDawn,
+                       dawnInfo.fSampleCount,
+                       dawnInfo.fMipmapped,
+                       Protected::kNo,
+                       DawnFormatBytesPerBlock(dawnInfo.getViewFormat())))
+        , fDawnSpec(dawnInfo) {
+    fHash = this->computeHash();
+    fCompatHash = this->computeCompatHash();
+}
 #endif
 
 #ifdef SK_VULKAN
 TextureInfo::TextureInfo(const VulkanTextureInfo& vkInfo)
-        : fBackend(BackendApi::kVulkan)
-        , fValid(true)
-        , fSampleCount(vkInfo.fSampleCount)
-        , fMipmapped(vkInfo.fMipmapped)
-        , fProtected(Protected::kNo)
+        : fPacked(Pack(BackendApi::kVulkan,
+                       vkInfo.fSampleCount,
+                       vkInfo.fMipmapped,
+                       (vkInfo.fFlags & VK_IMAGE_CREATE_PROTECTED_BIT) ? Protected::kYes
+                                                                       : Protected::kNo,
+                       VkFormatBytesPerBlock(vkInfo.fFormat)))
         , fVkSpec(vkInfo) {
-    if (vkInfo.fFlags & VK_IMAGE_CREATE_PROTECTED_BIT) {
-        fProtected = Protected::kYes;
-    }
+    fHash = this->computeHash();
+    fCompatHash = this->computeCompatHash();
 }
 #endif
 
-TextureInfo::TextureInfo(const TextureInfo& that)
-        : fBackend(that.fBackend)
-        , fValid(that.fValid)
-        , fSampleCount(that.fSampleCount)
-        , fMipmapped(that.fMipmapped)
-        , fProtected(that.fProtected) {
-    if (!fValid) {
-        return;
-    }
+// The YCbCr state participates identically in equality and compatibility, so both hash
+// computations chain through these helpers, folding the fields into the running seed.
+#if defined(SK_DAWN) && !defined(__EMSCRIPTEN__)
+static uint32_t add_ycbcr_hash(const wgpu::YCbCrVkDescriptor& desc, uint32_t seed) {
+    const uint64_t fields[] = {
+            static_cast<uint64_t>(desc.vkFormat),
+            static_cast<uint64_t>(desc.vkYCbCrRange),
+            static_cast<uint64_t>(desc.vkComponentSwizzleRed),
+            static_cast<uint64_t>(desc.vkComponentSwizzleGreen),
+            static_cast<uint64_t>(desc.vkComponentSwizzleBlue),
+            static_cast<uint64_t>(desc.vkComponentSwizzleAlpha),
+            static_cast<uint64_t>(desc.vkXChromaOffset),
+            static_cast<uint64_t>(desc.vkYChromaOffset),
+            static_cast<uint64_t>(desc.vkChromaFilter),
+            static_cast<uint64_t>(desc.forceExplicitReconstruction),
+            static_cast<uint64_t>(desc.externalFormat),
+    };
+    return SkChecksum::Hash32(fields, sizeof(fields), seed);
+}
+#endif
 
-    switch (that.backend()) {
-        case BackendApi::kMetal:
-            fTextureInfoData.reset();
-            that.fTextureInfoData->copyTo(fTextureInfoData);
-            break;
+#ifdef SK_VULKAN
+static uint32_t add_ycbcr_hash(const VulkanYcbcrConversionInfo& ycbcr, uint32_t seed) {
+    // Any two invalid conversion infos compare equal regardless of their other fields, so only
+    // a valid one may contribute its fields to the hash.
+    const bool ycbcrValid = ycbcr.isValid();
+    const uint64_t fields[] = {
+            static_cast<uint64_t>(ycbcrValid),
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fFormat) : 0,
+            ycbcrValid ? ycbcr.fExternalFormat : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fYcbcrModel) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fYcbcrRange) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fXChromaOffset) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fYChromaOffset) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fChromaFilter) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fForceExplicitReconstruction) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fComponents.r) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fComponents.g) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fComponents.b) : 0,
+            ycbcrValid ? static_cast<uint64_t>(ycbcr.fComponents.a) : 0,
+    };
+    return SkChecksum::Hash32(fields, sizeof(fields), seed);
+}
+#endif
+
+uint32_t TextureInfo::computeHash() const {
+    SkASSERT(this->isValid());
+    // The specs contain padding (and Dawn's YCbCr descriptor carries a chained-struct pointer
+    // that equality ignores), so the fields that participate in operator== are widened into a
+    // flat array rather than hashing the raw struct bytes.
+    switch (this->backend()) {
+#ifdef SK_METAL
+        case BackendApi::kMetal: {
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fMtlSpec.fFormat),
+                    static_cast<uint64_t>(fMtlSpec.fUsage),
+                    static_cast<uint64_t>(fMtlSpec.fStorageMode),
+                    static_cast<uint64_t>(fMtlSpec.fFramebufferOnly),
+            };
+            return SkChecksum::Hash32(fields, sizeof(fields), fPacked);
+        }
+#endif
 #ifdef SK_DAWN
-        case BackendApi::kDawn:
-            fDawnSpec = that.fDawnSpec;
-            break;
+        case BackendApi::kDawn: {
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fDawnSpec.fFormat),
+                    static_cast<uint64_t>(fDawnSpec.fViewFormat),
+                    static_cast<uint64_t>(fDawnSpec.fUsage),
+                    static_cast<uint64_t>(fDawnSpec.fAspect),
+                    static_cast<uint64_t>(fDawnSpec.fSlice),
+            };
+            uint32_t hash = SkChecksum::Hash32(fields, sizeof(fields), fPacked);
+#if !defined(__EMSCRIPTEN__)
+            hash = add_ycbcr_hash(fDawnSpec.fYcbcrVkDescriptor, hash);
+#endif
+            return hash;
+        }
 #endif
 #ifdef SK_VULKAN
-        case BackendApi::kVulkan:
-            fVkSpec = that.fVkSpec;
-            break;
+        case BackendApi::kVulkan: {
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fVkSpec.fFlags),
+                    static_cast<uint64_t>(fVkSpec.fFormat),
+                    static_cast<uint64_t>(fVkSpec.fImageTiling),
+                    static_cast<uint64_t>(fVkSpec.fImageUsageFlags),
+                    static_cast<uint64_t>(fVkSpec.fSharingMode),
+                    static_cast<uint64_t>(fVkSpec.fAspectMask),
+            };
+            return add_ycbcr_hash(fVkSpec.fYcbcrConversionInfo,
+                                  SkChecksum::Hash32(fields, sizeof(fields), fPacked));
+        }
 #endif
         default:
-            SK_ABORT("Unsupport Backend");
+            // Only the backend constructors compute a hash; no valid mock infos exist.
+            return 0;
     }
 }
 
-TextureInfo& TextureInfo::operator=(const TextureInfo& that) {
-    if (this != &that) {
-        this->~TextureInfo();
-        new (this) TextureInfo(that);
+uint32_t TextureInfo::computeCompatHash() const {
+    SkASSERT(this->isValid());
+    // Seed with the masked scalar word and hash only the spec fields that isCompatible requires
+    // to match exactly. Fields with asymmetric rules -- Metal and Vulkan usage supersets, Dawn's
+    // usage and its wildcard aspect, the Dawn slice -- are left out entirely, so two compatible
+    // infos always hash alike and a hash mismatch proves incompatibility.
+    switch (this->backend()) {
+#ifdef SK_METAL
+        case BackendApi::kMetal: {
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fMtlSpec.fFormat),
+                    static_cast<uint64_t>(fMtlSpec.fStorageMode),
+                    static_cast<uint64_t>(fMtlSpec.fFramebufferOnly),
+            };
+            return SkChecksum::Hash32(fields, sizeof(fields), fPacked & kCompatibilityMask);
+        }
+#endif
+#ifdef SK_DAWN
+        case BackendApi::kDawn: {
+            // Dawn compatibility only inspects the view format (plus the YCbCr state); the raw
+            // texture format may differ between a multiplanar texture and its plane view.
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fDawnSpec.getViewFormat()),
+            };
+            uint32_t hash = SkChecksum::Hash32(fields, sizeof(fields),
+                                               fPacked & kCompatibilityMask);
+#if !defined(__EMSCRIPTEN__)
+            hash = add_ycbcr_hash(fDawnSpec.fYcbcrVkDescriptor, hash);
+#endif
+            return hash;
+        }
+#endif
+#ifdef SK_VULKAN
+        case BackendApi::kVulkan: {
+            const uint64_t fields[] = {
+                    static_cast<uint64_t>(fVkSpec.fFlags),
+                    static_cast<uint64_t>(fVkSpec.fFormat),
+                    static_cast<uint64_t>(fVkSpec.fImageTiling),
+                    static_cast<uint64_t>(fVkSpec.fSharingMode),
+                    static_cast<uint64_t>(fVkSpec.fAspectMask),
+            };
+            return add_ycbcr_hash(
+                    fVkSpec.fYcbcrConversionInfo,
+                    SkChecksum::Hash32(fields, sizeof(fields), fPacked & kCompatibilityMask));
+        }
+#endif
+        default:
+            return 0;
     }
-    return *this;
 }
 
 bool TextureInfo::operator==(const TextureInfo& that) const {
-    if (!this->isValid() && !that.isValid()) {
-        return true;
-    }
-    if (!this->isValid() || !that.isValid()) {
-        return false;
-    }
-
-    if (fBackend != that.fBackend) {
+    // fHash covers fPacked and the active spec, so a mismatch proves inequality and only equal
+    // hashes need the field-by-field confirmation below.
+    if (fHash != that.fHash || fPacked != that.fPacked) {
         return false;
     }
-
-    if (fSampleCount != that.fSampleCount ||
-        fMipmapped != that.fMipmapped ||
-        fProtected != that.fProtected) {
-        return false;
+    if (!this->isValid()) {
+        // Both are invalid (the backend tags matched above), so they compare equal.
+        return true;
     }
 
-    switch (fBackend) {
+    switch (this->backend()) {
+#ifdef SK_METAL
         case BackendApi::kMetal:
-            return fTextureInfoData->equal(that.fTextureInfoData.get());
+            return fMtlSpec == that.fMtlSpec;
+#endif
 #ifdef SK_DAWN
         case BackendApi::kDawn:
             return fDawnSpec == that.fDawnSpec;
@@ -119,23 +233,24 @@ bool TextureInfo::operator==(const TextureInfo& that) const {
 }
 
 bool TextureInfo::isCompatible(const TextureInfo& that) const {
-    if (!this->isValid() || !that.isValid()) {
+    // fCompatHash covers the masked scalar word and the symmetric spec fields, so differing
+    // hashes prove incompatibility and most mismatches bail on the first compare. Hashes can
+    // collide, so a tie still has to run the full checks below.
+    if (fCompatHash != that.fCompatHash) {
         return false;
     }
-
-    if (fSampleCount != that.fSampleCount ||
-        fMipmapped != that.fMipmapped ||
-        fProtected != that.fProtected) {
-        return false;
-    }
-
-    if (fBackend != that.fBackend) {
+    // One masked XOR covers backend (which doubles as the valid flag), sample count, mipmapped,
+    // protected, and bytes-per-pixel in a single compare. After the masks match the two backend
+    // tags are equal, so a lone isValid() check rejects the invalid/invalid pair.
+    if (((fPacked ^ that.fPacked) & kCompatibilityMask) != 0 || !this->isValid()) {
         return false;
     }
 
-    switch (fBackend) {
+    switch (this->backend()) {
+#ifdef SK_METAL
         case BackendApi::kMetal:
-            return fTextureInfoData->isCompatible(that.fTextureInfoData.get());
+            return fMtlSpec.isCompatible(that.fMtlSpec);
+#endif
 #ifdef SK_DAWN
         case BackendApi::kDawn:
             return fDawnSpec.isCompatible(that.fDawnSpec);
@@ -151,109 +266,177 @@ bool TextureInfo::isCompatible(const TextureInfo& that) const {
 
 #ifdef SK_DAWN
 bool TextureInfo::getDawnTextureInfo(DawnTextureInfo* info) const {
-    if (!this->isValid() || fBackend != BackendApi::kDawn) {
+    if (!this->isValid() || this->backend() != BackendApi::kDawn) {
         return false;
     }
-    *info = DawnTextureSpecToTextureInfo(fDawnSpec, fSampleCount, fMipmapped);
+    *info = DawnTextureSpecToTextureInfo(fDawnSpec, this->numSamples(), this->mipmapped());
     return true;
 }
 #endif
 
-SkString TextureInfo::toString() const {
-    SkString ret;
-    switch (fBackend) {
-        case BackendApi::kMetal:
-            ret = fTextureInfoData->toString();
-            break;
+// The static per-backend dispatch table for cold operations. The entry functions are nested in
+// TextureInfo so they can reach the spec union directly; the table itself is indexed by the
+// numeric BackendApi value stored in fPacked.
+struct TextureInfo::BackendOps {
+    void (*fAppendSpecTo)(const TextureInfo&, SkString*);
+    void (*fAppendRPAttachmentTo)(const TextureInfo&, SkString*);
+    SkTextureCompressionType (*fCompressionType)(const TextureInfo&);
+
 #ifdef SK_DAWN
-        case BackendApi::kDawn:
-            ret.appendf("Dawn(%s,", fDawnSpec.toString().c_str());
-            break;
-#endif
-#ifdef SK_VULKAN
-        case BackendApi::kVulkan:
-            ret.appendf("Vulkan(%s,", fVkSpec.toString().c_str());
-            break;
-#endif
-        case BackendApi::kMock:
-            ret += "Mock(";
-            break;
-        default:
-            ret += "Invalid(";
-            break;
+    static void DawnAppendSpec(const TextureInfo& info, SkString* str) {
+        *str += "Dawn(";
+        info.fDawnSpec.appendTo(str);
+        *str += ",";
     }
-    ret.appendf("bytesPerPixel=%zu,sampleCount=%u,mipmapped=%d,protected=%d)",
-                this->bytesPerPixel(),
-                fSampleCount,
-                static_cast<int>(fMipmapped),
-                static_cast<int>(fProtected));
-    return ret;
-}
+    static void DawnAppendRPAttachment(const TextureInfo& info, SkString* str) {
+        str->appendf("Dawn(f=%u,s=%u)",
+                     static_cast<unsigned int>(info.fDawnSpec.fViewFormat),
+                     info.numSamples());
+    }
+    static SkTextureCompressionType DawnCompressionType(const TextureInfo& info) {
+        return DawnFormatToCompressionType(info.fDawnSpec.getViewFormat());
+    }
+#endif
 
-SkString TextureInfo::toRPAttachmentString() const {
-    // For renderpass attachments, the string will contain the view format and sample count only
-    switch (fBackend) {
-        case BackendApi::kMetal:
-            return fTextureInfoData->toRPAttachmentString(fSampleCount);
-#ifdef SK_DAWN
-        case BackendApi::kDawn:
-            return SkStringPrintf("Dawn(f=%u,s=%u)",
-                                  static_cast<unsigned int>(fDawnSpec.fViewFormat), fSampleCount);
+#ifdef SK_METAL
+    static void MtlAppendSpec(const TextureInfo& info, SkString* str) {
+        *str += "Metal(";
+        info.fMtlSpec.appendTo(str);
+        *str += ",";
+    }
+    static void MtlAppendRPAttachment(const TextureInfo& info, SkString* str) {
+        str->appendf("Metal(f=%u,s=%u)", info.fMtlSpec.fFormat, info.numSamples());
+    }
+    static SkTextureCompressionType MtlCompressionType(const TextureInfo& info) {
+        return MtlFormatToCompressionType(info.fMtlSpec.fFormat);
+    }
 #endif
+
 #ifdef SK_VULKAN
-        case BackendApi::kVulkan:
-            return SkStringPrintf("Vulkan(f%u,s=%u)",
-                                  static_cast<unsigned int>(fVkSpec.fFormat), fSampleCount);
+    static void VkAppendSpec(const TextureInfo& info, SkString* str) {
+        *str += "Vulkan(";
+        info.fVkSpec.appendTo(str);
+        *str += ",";
+    }
+    static void VkAppendRPAttachment(const TextureInfo& info, SkString* str) {
+        str->appendf("Vulkan(f%u,s=%u)",
+                     static_cast<unsigned int>(info.fVkSpec.fFormat),
+                     info.numSamples());
+    }
+    static SkTextureCompressionType VkCompressionType(const TextureInfo& info) {
+        return VkFormatToCompressionType(info.fVkSpec.fFormat);
+    }
 #endif
-        case BackendApi::kMock:
-            return SkStringPrintf("Mock(s=%u)", fSampleCount);
-        default:
-            return SkString("Invalid");
+
+    static void MockAppendSpec(const TextureInfo&, SkString* str) { *str += "Mock("; }
+    static void MockAppendRPAttachment(const TextureInfo& info, SkString* str) {
+        str->appendf("Mock(s=%u)", info.numSamples());
     }
-}
 
-size_t TextureInfo::bytesPerPixel() const {
-    if (!this->isValid()) {
-        return 0;
+    static void InvalidAppendSpec(const TextureInfo&, SkString* str) { *str += "Invalid("; }
+    static void InvalidAppendRPAttachment(const TextureInfo&, SkString* str) {
+        *str += "Invalid";
     }
+    static SkTextureCompressionType NoCompressionType(const TextureInfo&) {
+        return SkTextureCompressionType::kNone;
+    }
+};
 
-    switch (fBackend) {
-        case BackendApi::kMetal:
-            return fTextureInfoData->bytesPerPixel();
 #ifdef SK_DAWN
-        case BackendApi::kDawn:
-            return DawnFormatBytesPerBlock(this->dawnTextureSpec().getViewFormat());
+#define DAWN_OPS                                                             \
+    { &TextureInfo::BackendOps::DawnAppendSpec,                              \
+      &TextureInfo::BackendOps::DawnAppendRPAttachment,                      \
+      &TextureInfo::BackendOps::DawnCompressionType }
+#else
+#define DAWN_OPS                                                             \
+    { &TextureInfo::BackendOps::InvalidAppendSpec,                           \
+      &TextureInfo::BackendOps::InvalidAppendRPAttachment,                   \
+      &TextureInfo::BackendOps::NoCompressionType }
+#endif
+#ifdef SK_METAL
+#define MTL_OPS                                                              \
+    { &TextureInfo::BackendOps::MtlAppendSpec,                               \
+      &TextureInfo::BackendOps::MtlAppendRPAttachment,                       \
+      &TextureInfo::BackendOps::MtlCompressionType }
+#else
+#define MTL_OPS                                                              \
+    { &TextureInfo::BackendOps::InvalidAppendSpec,                           \
+      &TextureInfo::BackendOps::InvalidAppendRPAttachment,                   \
+      &TextureInfo::BackendOps::NoCompressionType }
 #endif
 #ifdef SK_VULKAN
-        case BackendApi::kVulkan:
-            return VkFormatBytesPerBlock(this->vulkanTextureSpec().fFormat);
+#define VK_OPS                                                               \
+    { &TextureInfo::BackendOps::VkAppendSpec,                                \
+      &TextureInfo::BackendOps::VkAppendRPAttachment,                        \
+      &TextureInfo::BackendOps::VkCompressionType }
+#else
+#define VK_OPS                                                               \
+    { &TextureInfo::BackendOps::InvalidAppendSpec,                           \
+      &TextureInfo::BackendOps::InvalidAppendRPAttachment,                   \
+      &TextureInfo::BackendOps::NoCompressionType }
 #endif
-        default:
-            return 0;
+
+// Indexed by the numeric values of BackendApi: kDawn, kMetal, kVulkan, kMock, kUnsupported.
+const TextureInfo::BackendOps TextureInfo::kBackendOps[] = {
+        DAWN_OPS,
+        MTL_OPS,
+        VK_OPS,
+        { &TextureInfo::BackendOps::MockAppendSpec,
+          &TextureInfo::BackendOps::MockAppendRPAttachment,
+          &TextureInfo::BackendOps::NoCompressionType },
+        { &TextureInfo::BackendOps::InvalidAppendSpec,
+          &TextureInfo::BackendOps::InvalidAppendRPAttachment,
+          &TextureInfo::BackendOps::NoCompressionType },
+};
+
+#undef DAWN_OPS
+#undef MTL_OPS
+#undef VK_OPS
+
+const TextureInfo::BackendOps& TextureInfo::Ops(BackendApi backend) {
+    static_assert(static_cast<unsigned>(BackendApi::kDawn) == 0);
+    static_assert(static_cast<unsigned>(BackendApi::kMetal) == 1);
+    static_assert(static_cast<unsigned>(BackendApi::kVulkan) == 2);
+    static_assert(static_cast<unsigned>(BackendApi::kMock) == 3);
+    static_assert(static_cast<unsigned>(BackendApi::kUnsupported) == 4);
+    unsigned index = static_cast<unsigned>(backend);
+    if (index >= std::size(kBackendOps)) {
+        index = static_cast<unsigned>(BackendApi::kUnsupported);
     }
+    return kBackendOps[index];
+}
+
+void TextureInfo::appendTo(SkString* str) const {
+    Ops(this->backend()).fAppendSpecTo(*this, str);
+    str->appendf("bytesPerPixel=%zu,sampleCount=%u,mipmapped=%d,protected=%d)",
+                 this->bytesPerPixel(),
+                 this->numSamples(),
+                 static_cast<int>(this->mipmapped()),
+                 static_cast<int>(this->isProtected()));
+}
+
+void TextureInfo::appendRPAttachmentTo(SkString* str) const {
+    // For renderpass attachments, the string will contain the view format and sample count only
+    Ops(this->backend()).fAppendRPAttachmentTo(*this, str);
+}
+
+SkString TextureInfo::toString() const {
+    SkString ret;
+    this->appendTo(&ret);
+    return ret;
+}
+
+SkString TextureInfo::toRPAttachmentString() const {
+    SkString ret;
+    this->appendRPAttachmentTo(&ret);
+    return ret;
 }
 
 SkTextureCompressionType TextureInfo::compressionType() const {
     if (!this->isValid()) {
         return SkTextureCompressionType::kNone;
     }
-
-    switch (fBackend) {
-        case BackendApi::kMetal:
-            return fTextureInfoData->compressionType();
-#ifdef SK_DAWN
-        case BackendApi::kDawn:
-            return DawnFormatToCompressionType(this->dawnTextureSpec().getViewFormat());
-#endif
-#ifdef SK_VULKAN
-        case BackendApi::kVulkan:
-            return VkFormatToCompressionType(this->vulkanTextureSpec().fFormat);
-#endif
-        default:
-            return SkTextureCompressionType::kNone;
-    }
+    return Ops(this->backend()).fCompressionType(*this);
 }
 
-TextureInfoData::~TextureInfoData(){};
-
 } // namespace skgpu::graphite
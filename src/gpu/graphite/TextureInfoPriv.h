@@ -7,53 +7,47 @@
 #ifndef skgpu_graphite_TextureInfoPriv_DEFINED
 #define skgpu_graphite_TextureInfoPriv_DEFINED
 
-#include "include/core/SkString.h"
 #include "include/gpu/graphite/TextureInfo.h"
 
 #include <cstdint>
 
 namespace skgpu::graphite {
 
-class TextureInfoData {
+class TextureInfoPriv {
 public:
-    virtual ~TextureInfoData();
-
-#if defined(SK_DEBUG)
-    virtual skgpu::BackendApi type() const = 0;
-#endif
-protected:
-    TextureInfoData() = default;
-    TextureInfoData(const TextureInfoData&) = default;
-
-    using AnyTextureInfoData = TextureInfo::AnyTextureInfoData;
-
-private:
-    friend class TextureInfo;
-
-    virtual size_t bytesPerPixel() const = 0;
-    virtual SkTextureCompressionType compressionType() const = 0;
-    virtual SkString toString() const = 0;
-    virtual SkString toRPAttachmentString(uint32_t sampleCount) const = 0;
+    // Returns the index of the first entry in infos equal to needle, or -1 if there is none.
+    // The cached equality hash rejects each non-match with a single word compare, so the
+    // out-of-line full comparison only runs for entries whose hashes collide with the needle's.
+    static int FindMatchingTextureInfo(const TextureInfo* infos,
+                                       size_t count,
+                                       const TextureInfo& needle) {
+        for (size_t i = 0; i < count; ++i) {
+            if (infos[i].fHash == needle.fHash && infos[i] == needle) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
 
-    virtual void copyTo(AnyTextureInfoData&) const = 0;
-    virtual bool equal(const TextureInfoData* that) const = 0;
-    virtual bool isCompatible(const TextureInfoData* that) const = 0;
-};
+    // The cached hash of the compatibility subset of info's state. Two compatible infos always
+    // share this value, so tables that bucket render targets by compatibility (rather than exact
+    // equality) can key on it directly; colliding entries still need a full isCompatible() check.
+    static uint32_t CompatibilityHash(const TextureInfo& info) {
+        return info.fCompatHash;
+    }
 
-class TextureInfoPriv {
-public:
-    template <typename SomeTextureInfoData>
-    static TextureInfo Make(BackendApi backend,
-                            uint32_t sampleCount,
-                            skgpu::Mipmapped mipped,
-                            skgpu::Protected p,
-                            const SomeTextureInfoData& data) {
-        return TextureInfo(backend, sampleCount, mipped, p, data);
+#ifdef SK_METAL
+    static TextureInfo MakeMtl(const MtlTextureSpec& spec,
+                               uint32_t sampleCount,
+                               skgpu::Mipmapped mipped,
+                               skgpu::Protected isProtected) {
+        return TextureInfo(spec, sampleCount, mipped, isProtected);
     }
 
-    static const TextureInfoData* GetData(const TextureInfo& info) {
-        return info.fTextureInfoData.get();
+    static const MtlTextureSpec& GetMtlTextureSpec(const TextureInfo& info) {
+        return info.mtlTextureSpec();
     }
+#endif
 };
 
 }  // namespace skgpu::graphite
@@ -9,13 +9,13 @@
 
 namespace skgpu::graphite {
 
-SkString DawnTextureSpec::toString() const {
-    return SkStringPrintf("format=0x%08X,viewFormat=0x%08X,usage=0x%08X,aspect=0x%08X,slice=%u",
-                          static_cast<unsigned int>(fFormat),
-                          static_cast<unsigned int>(fViewFormat),
-                          static_cast<unsigned int>(fUsage),
-                          static_cast<unsigned int>(fAspect),
-                          fSlice);
+void DawnTextureSpec::appendTo(SkString* str) const {
+    str->appendf("format=0x%08X,viewFormat=0x%08X,usage=0x%08X,aspect=0x%08X,slice=%u",
+                 static_cast<unsigned int>(fFormat),
+                 static_cast<unsigned int>(fViewFormat),
+                 static_cast<unsigned int>(fUsage),
+                 static_cast<unsigned int>(fAspect),
+                 fSlice);
 }
 
 DawnTextureInfo DawnTextureInfoFromWGPUTexture(WGPUTexture texture) {
@@ -8,7 +8,7 @@
 #include "include/gpu/MutableTextureState.h"
 #include "include/gpu/graphite/mtl/MtlGraphiteTypes.h"
 #include "src/gpu/graphite/BackendSemaphorePriv.h"
-#include "src/gpu/graphite/mtl/MtlGraphiteTypesPriv.h"
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
 #include "src/gpu/mtl/MtlUtilsPriv.h"
 
 #include <cstdint>
@@ -40,6 +40,9 @@ private:
     }
 };
 
+// Keeps BackendSemaphore's inline storage sized exactly to this subclass.
+static_assert(sizeof(MtlBackendSemaphoreData) == BackendSemaphorePriv::kMtlEventDataSize);
+
 static const MtlBackendSemaphoreData* get_and_cast_data(const BackendSemaphore& sem) {
     auto data = BackendSemaphorePriv::GetData(sem);
     SkASSERT(!data || data->type() == skgpu::BackendApi::kMetal);
@@ -5,7 +5,7 @@
  * found in the LICENSE file.
  */
 
-#include "src/gpu/graphite/mtl/MtlGraphiteTypesPriv.h"
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
 
 #import <Metal/Metal.h>
 
@@ -24,6 +24,15 @@ MtlTextureInfo::MtlTextureInfo(CFTypeRef texture) {
     fFramebufferOnly = mtlTex.framebufferOnly;
 }
 
+MtlTextureSpec MtlTextureInfoToTextureSpec(const MtlTextureInfo& info) {
+    MtlTextureSpec spec;
+    spec.fFormat = static_cast<MtlPixelFormat>(info.fFormat);
+    spec.fUsage = static_cast<MtlTextureUsage>(info.fUsage);
+    spec.fStorageMode = static_cast<MtlStorageMode>(info.fStorageMode);
+    spec.fFramebufferOnly = info.fFramebufferOnly;
+    return spec;
+}
+
 MtlTextureInfo MtlTextureSpecToTextureInfo(const MtlTextureSpec& mtlSpec,
                                            uint32_t sampleCount,
                                            Mipmapped mipmapped) {
@@ -33,9 +42,9 @@ MtlTextureInfo MtlTextureSpecToTextureInfo(const MtlTextureSpec& mtlSpec,
     info.fMipmapped = mipmapped;
 
     // Mtl info
-    info.fFormat = mtlSpec.fFormat;
-    info.fUsage = mtlSpec.fUsage;
-    info.fStorageMode = mtlSpec.fStorageMode;
+    info.fFormat = static_cast<MTLPixelFormat>(mtlSpec.fFormat);
+    info.fUsage = static_cast<MTLTextureUsage>(mtlSpec.fUsage);
+    info.fStorageMode = static_cast<MTLStorageMode>(mtlSpec.fStorageMode);
     info.fFramebufferOnly = mtlSpec.fFramebufferOnly;
 
     return info;
@@ -10,6 +10,7 @@
 
 #include "include/gpu/ShaderErrorHandler.h"
 #include "include/gpu/graphite/Context.h"
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/graphite/ContextPriv.h"
 #include "src/gpu/graphite/mtl/MtlQueueManager.h"
@@ -18,6 +19,14 @@
 
 namespace skgpu::graphite {
 
+size_t MtlFormatBytesPerBlock(MtlPixelFormat format) {
+    return skgpu::MtlFormatBytesPerBlock(static_cast<MTLPixelFormat>(format));
+}
+
+SkTextureCompressionType MtlFormatToCompressionType(MtlPixelFormat format) {
+    return skgpu::MtlFormatToCompressionType(static_cast<MTLPixelFormat>(format));
+}
+
 namespace ContextFactory {
 
 std::unique_ptr<Context> MakeMetal(const MtlBackendContext& backendContext,
@@ -11,7 +11,7 @@
 #include "include/gpu/graphite/mtl/MtlGraphiteTypes.h"
 #include "src/core/SkMipmap.h"
 #include "src/gpu/graphite/mtl/MtlCaps.h"
-#include "src/gpu/graphite/mtl/MtlGraphiteTypesPriv.h"
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
 #include "src/gpu/graphite/mtl/MtlSharedContext.h"
 #include "src/gpu/mtl/MtlUtilsPriv.h"
 
@@ -34,7 +34,8 @@ sk_cfp<id<MTLTexture>> MtlTexture::MakeMtlTexture(const MtlSharedContext* shared
     }
 
     if (mtlSpec.fUsage & MTLTextureUsageRenderTarget &&
-        !(caps->isRenderable(info) || MtlFormatIsDepthOrStencil(mtlSpec.fFormat))) {
+        !(caps->isRenderable(info) ||
+          MtlFormatIsDepthOrStencil(static_cast<MTLPixelFormat>(mtlSpec.fFormat)))) {
         return nullptr;
     }
 
@@ -49,15 +50,15 @@ sk_cfp<id<MTLTexture>> MtlTexture::MakeMtlTexture(const MtlSharedContext* shared
 
     sk_cfp<MTLTextureDescriptor*> desc([[MTLTextureDescriptor alloc] init]);
     (*desc).textureType = (info.numSamples() > 1) ? MTLTextureType2DMultisample : MTLTextureType2D;
-    (*desc).pixelFormat = mtlSpec.fFormat;
+    (*desc).pixelFormat = static_cast<MTLPixelFormat>(mtlSpec.fFormat);
     (*desc).width = dimensions.width();
     (*desc).height = dimensions.height();
     (*desc).depth = 1;
     (*desc).mipmapLevelCount = numMipLevels;
     (*desc).sampleCount = info.numSamples();
     (*desc).arrayLength = 1;
-    (*desc).usage = mtlSpec.fUsage;
-    (*desc).storageMode = mtlSpec.fStorageMode;
+    (*desc).usage = static_cast<MTLTextureUsage>(mtlSpec.fUsage);
+    (*desc).storageMode = static_cast<MTLStorageMode>(mtlSpec.fStorageMode);
 
     sk_cfp<id<MTLTexture>> texture([sharedContext->device() newTextureWithDescriptor:desc.get()]);
     return texture;
@@ -6,8 +6,8 @@
  */
 #include "include/core/SkString.h"
 #include "include/gpu/graphite/mtl/MtlGraphiteTypes.h"
+#include "include/private/gpu/graphite/MtlGraphiteTypesPriv.h"
 #include "src/gpu/graphite/TextureInfoPriv.h"
-#include "src/gpu/graphite/mtl/MtlGraphiteTypesPriv.h"
 #include "src/gpu/mtl/MtlUtilsPriv.h"
 
 #include <cstdint>
@@ -16,76 +16,16 @@
 
 namespace skgpu::graphite {
 
-class MtlTextureInfoData final : public TextureInfoData {
-public:
-    MtlTextureInfoData(MtlTextureSpec m) : fMtlSpec(m) {}
-
-#if defined(SK_DEBUG)
-    skgpu::BackendApi type() const override { return skgpu::BackendApi::kMetal; }
-#endif
-
-    MtlTextureSpec spec() const { return fMtlSpec; }
-
-private:
-    MtlTextureSpec fMtlSpec;
-
-    size_t bytesPerPixel() const override {
-        return MtlFormatBytesPerBlock(static_cast<MTLPixelFormat>(fMtlSpec.fFormat));
-    }
-
-    SkTextureCompressionType compressionType() const override {
-        return MtlFormatToCompressionType(static_cast<MTLPixelFormat>(fMtlSpec.fFormat));
-    }
-
-    SkString toString() const override {
-        return SkStringPrintf("Metal(%s,", fMtlSpec.toString().c_str());
-    }
-
-    SkString toRPAttachmentString(uint32_t sampleCount) const override {
-        return SkStringPrintf(
-                "Metal(f=%u,s=%u)", static_cast<unsigned int>(fMtlSpec.fFormat), sampleCount);
-    }
-
-    void copyTo(AnyTextureInfoData& dstData) const override {
-        // Don't assert that dstData is a metal type because it could be
-        // uninitialized and that assert would fail.
-        dstData.emplace<MtlTextureInfoData>(fMtlSpec);
-    }
-
-    bool equal(const TextureInfoData* that) const override {
-        SkASSERT(!that || that->type() == skgpu::BackendApi::kMetal);
-        if (auto otherMtl = static_cast<const MtlTextureInfoData*>(that)) {
-            return fMtlSpec == otherMtl->fMtlSpec;
-        }
-        return false;
-    }
-
-    bool isCompatible(const TextureInfoData* that) const override {
-        SkASSERT(!that || that->type() == skgpu::BackendApi::kMetal);
-        if (auto otherMtl = static_cast<const MtlTextureInfoData*>(that)) {
-            return fMtlSpec.isCompatible(otherMtl->fMtlSpec);
-        }
-        return false;
-    }
-};
-
-static const MtlTextureInfoData* get_and_cast_data(const TextureInfo& info) {
-    auto data = TextureInfoPriv::GetData(info);
-    SkASSERT(!data || data->type() == skgpu::BackendApi::kMetal);
-    return static_cast<const MtlTextureInfoData*>(data);
-}
-
 namespace TextureInfos {
 skgpu::graphite::TextureInfo MakeMetal(CFTypeRef mtlTexture) {
     return MakeMetal(MtlTextureInfo(mtlTexture));
 }
 
 skgpu::graphite::TextureInfo MakeMetal(const MtlTextureInfo& mtlInfo) {
-    return TextureInfoPriv::Make(skgpu::BackendApi::kMetal,
-                                 mtlInfo.fSampleCount,
-                                 mtlInfo.fMipmapped,
-                                 Protected::kNo,
-                                 MtlTextureInfoData(mtlInfo));
+    return TextureInfoPriv::MakeMtl(MtlTextureInfoToTextureSpec(mtlInfo),
+                                    mtlInfo.fSampleCount,
+                                    mtlInfo.fMipmapped,
+                                    Protected::kNo);
 }
 
 bool GetMtlTextureInfo(const TextureInfo& info, MtlTextureInfo* out) {
@@ -93,9 +33,9 @@ bool GetMtlTextureInfo(const TextureInfo& info, MtlTextureInfo* out) {
         return false;
     }
     SkASSERT(out);
-    const MtlTextureInfoData* mtlData = get_and_cast_data(info);
-    SkASSERT(mtlData);
-    *out = MtlTextureSpecToTextureInfo(mtlData->spec(), info.numSamples(), info.mipmapped());
+    *out = MtlTextureSpecToTextureInfo(TextureInfoPriv::GetMtlTextureSpec(info),
+                                       info.numSamples(),
+                                       info.mipmapped());
     return true;
 }
 
@@ -103,42 +43,36 @@ bool GetMtlTextureInfo(const TextureInfo& info, MtlTextureInfo* out) {
 // a reference to a temporary local variable.
 MtlTextureSpec GetMtlTextureSpec(const TextureInfo& info) {
     SkASSERT(info.isValid() && info.backend() == skgpu::BackendApi::kMetal);
-    const MtlTextureInfoData* mtlData = get_and_cast_data(info);
-    SkASSERT(mtlData);
-    return mtlData->spec();
+    return TextureInfoPriv::GetMtlTextureSpec(info);
 }
 
 MTLPixelFormat GetMTLPixelFormat(const TextureInfo& info) {
     SkASSERT(info.isValid() && info.backend() == skgpu::BackendApi::kMetal);
-    const MtlTextureInfoData* mtlData = get_and_cast_data(info);
-    SkASSERT(mtlData);
-    return mtlData->spec().fFormat;
+    return static_cast<MTLPixelFormat>(TextureInfoPriv::GetMtlTextureSpec(info).fFormat);
 }
 
 MTLTextureUsage GetMTLTextureUsage(const TextureInfo& info) {
     SkASSERT(info.isValid() && info.backend() == skgpu::BackendApi::kMetal);
-    const MtlTextureInfoData* mtlData = get_and_cast_data(info);
-    SkASSERT(mtlData);
-    return mtlData->spec().fUsage;
+    return static_cast<MTLTextureUsage>(TextureInfoPriv::GetMtlTextureSpec(info).fUsage);
 }
 
 bool GetMtlFramebufferOnly(const TextureInfo& info) {
     SkASSERT(info.isValid() && info.backend() == skgpu::BackendApi::kMetal);
-    const MtlTextureInfoData* mtlData = get_and_cast_data(info);
-    SkASSERT(mtlData);
-    return mtlData->spec().fFramebufferOnly;
+    return TextureInfoPriv::GetMtlTextureSpec(info).fFramebufferOnly;
 }
 
 }  // namespace TextureInfos
 
 #if defined(SK_METAL) && !defined(SK_DISABLE_LEGACY_TEXTURE_INFO_FUNCS)
 TextureInfo::TextureInfo(const MtlTextureInfo& mtlInfo)
-        : fBackend(BackendApi::kMetal)
-        , fValid(true)
-        , fSampleCount(mtlInfo.fSampleCount)
-        , fMipmapped(mtlInfo.fMipmapped)
-        , fProtected(Protected::kNo) {
-    fTextureInfoData.emplace<MtlTextureInfoData>(MtlTextureInfoData(mtlInfo));
+        : fPacked(Pack(BackendApi::kMetal,
+                       mtlInfo.fSampleCount,
+                       mtlInfo.fMipmapped,
+                       Protected::kNo,
+                       skgpu::MtlFormatBytesPerBlock(mtlInfo.fFormat)))
+        , fMtlSpec(MtlTextureInfoToTextureSpec(mtlInfo)) {
+    fHash = this->computeHash();
+    fCompatHash = this->computeCompatHash();
 }
 #endif
 
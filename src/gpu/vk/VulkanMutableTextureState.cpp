@@ -14,26 +14,76 @@
 #include "src/gpu/MutableTextureStatePriv.h"
 #include "src/gpu/vk/VulkanMutableTextureStatePriv.h"
 
+#include <atomic>
+#include <cstdint>
+
 namespace skgpu::MutableTextureStates {
 
+// A MutableTextureState can be shared between a client's BackendTexture and Skia's wrapped
+// texture object, and either side may update the layout or queue family while the other reads
+// it. Both values are packed into one atomic 64-bit word (layout in the low half, queue family
+// index in the high half) so a full state update is a single store, a read is a single load, and
+// neither tears.
 class VulkanMutableTextureState : public MutableTextureStateData {
 public:
     VulkanMutableTextureState(VkImageLayout layout, uint32_t queueFamilyIndex)
-            : fLayout(layout)
-            , fQueueFamilyIndex(queueFamilyIndex) {}
+            : fLayoutAndQueueFamilyIndex(Pack(layout, queueFamilyIndex)) {}
+
+    VulkanMutableTextureState(const VulkanMutableTextureState& that)
+            : fLayoutAndQueueFamilyIndex(
+                      that.fLayoutAndQueueFamilyIndex.load(std::memory_order_acquire)) {}
 
 #if defined(SK_DEBUG)
     BackendApi type() const override { return BackendApi::kVulkan; }
 #endif
 
     void copyTo(AnyStateData& formatData) const override {
-        formatData.emplace<VulkanMutableTextureState>(fLayout, fQueueFamilyIndex);
+        formatData.emplace<VulkanMutableTextureState>(*this);
+    }
+
+    VkImageLayout layout() const {
+        return static_cast<VkImageLayout>(
+                fLayoutAndQueueFamilyIndex.load(std::memory_order_acquire) & 0xFFFFFFFF);
     }
 
-    VkImageLayout fLayout;
-    uint32_t      fQueueFamilyIndex;
+    uint32_t queueFamilyIndex() const {
+        return static_cast<uint32_t>(
+                fLayoutAndQueueFamilyIndex.load(std::memory_order_acquire) >> 32);
+    }
+
+    void setLayout(VkImageLayout layout) {
+        uint64_t old = fLayoutAndQueueFamilyIndex.load(std::memory_order_relaxed);
+        uint64_t packed;
+        do {
+            packed = Pack(layout, static_cast<uint32_t>(old >> 32));
+        } while (!fLayoutAndQueueFamilyIndex.compare_exchange_weak(
+                old, packed, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void setQueueFamilyIndex(uint32_t queueFamilyIndex) {
+        uint64_t old = fLayoutAndQueueFamilyIndex.load(std::memory_order_relaxed);
+        uint64_t packed;
+        do {
+            packed = Pack(static_cast<VkImageLayout>(old & 0xFFFFFFFF), queueFamilyIndex);
+        } while (!fLayoutAndQueueFamilyIndex.compare_exchange_weak(
+                old, packed, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+private:
+    static uint64_t Pack(VkImageLayout layout, uint32_t queueFamilyIndex) {
+        return (static_cast<uint64_t>(queueFamilyIndex) << 32) |
+               static_cast<uint32_t>(layout);
+    }
+
+    std::atomic<uint64_t> fLayoutAndQueueFamilyIndex;
 };
 
+// Keeps MutableTextureState's inline storage sized exactly to this subclass. kVulkanStateSize
+// pads the vtable pointer out to the atomic word's alignment, which it assumes is the word's
+// full size (true even on i386, where a plain uint64_t is only 4-aligned).
+static_assert(alignof(std::atomic<uint64_t>) == sizeof(uint64_t));
+static_assert(sizeof(VulkanMutableTextureState) == MutableTextureStatePriv::kVulkanStateSize);
+
 MutableTextureState MakeVulkan(VkImageLayout layout, uint32_t queueFamilyIndex) {
     return MutableTextureStatePriv::MakeMutableTextureState(
             BackendApi::kVulkan,
@@ -60,34 +110,34 @@ static VulkanMutableTextureState* get_and_cast_data(MutableTextureState* mts) {
 
 VkImageLayout GetVkImageLayout(const MutableTextureState& state) {
     SkASSERT(state.backend() == BackendApi::kVulkan);
-    return get_and_cast_data(state)->fLayout;
+    return get_and_cast_data(state)->layout();
 }
 
 VkImageLayout GetVkImageLayout(const MutableTextureState* state) {
     SkASSERT(state);
     SkASSERT(state->backend() == BackendApi::kVulkan);
-    return get_and_cast_data(state)->fLayout;
+    return get_and_cast_data(state)->layout();
 }
 
 void SetVkImageLayout(MutableTextureState* state, VkImageLayout layout) {
     SkASSERT(state->backend() == BackendApi::kVulkan);
-    get_and_cast_data(state)->fLayout = layout;
+    get_and_cast_data(state)->setLayout(layout);
 }
 
 uint32_t GetVkQueueFamilyIndex(const MutableTextureState& state) {
     SkASSERT(state.backend() == BackendApi::kVulkan);
-    return get_and_cast_data(state)->fQueueFamilyIndex;
+    return get_and_cast_data(state)->queueFamilyIndex();
 }
 
 uint32_t GetVkQueueFamilyIndex(const MutableTextureState* state) {
     SkASSERT(state);
     SkASSERT(state->backend() == BackendApi::kVulkan);
-    return get_and_cast_data(state)->fQueueFamilyIndex;
+    return get_and_cast_data(state)->queueFamilyIndex();
 }
 
 void SetVkQueueFamilyIndex(MutableTextureState* state, uint32_t queueFamilyIndex) {
     SkASSERT(state->backend() == BackendApi::kVulkan);
-    get_and_cast_data(state)->fQueueFamilyIndex = queueFamilyIndex;
+    get_and_cast_data(state)->setQueueFamilyIndex(queueFamilyIndex);
 }
 
 }  // namespace skgpu::MutableTextureStates